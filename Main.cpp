@@ -5,6 +5,14 @@
 #include <algorithm>
 #include <map>
 #include <ctime>
+#include <string>
+#include <sstream>
+#include <tuple>
+#include <functional>
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
 
 #define SCREEN_WIDTH 720
 #define SCREEN_HEIGHT 720
@@ -92,26 +100,33 @@ class Projectile
 {
     protected:
     Vector2 projectilePosition;
+    Vector2 projectilePreviousPosition;
     Vector2 projectileDirection;
-    int projectileSpeed;
+    float projectileSpeed;
     int projectileDamage;
     int projectileSize;
     bool isActive;
     
     public:
-    Projectile(Vector2 position, Vector2 direction, int speed, int damage, int size)
-    : projectilePosition(position), projectileDirection(direction), projectileSpeed(speed), projectileDamage(damage), projectileSize(size), isActive(true) {}
+    Projectile(Vector2 position, Vector2 direction, float speed, int damage, int size)
+    : projectilePosition(position), projectilePreviousPosition(position), projectileDirection(direction), projectileSpeed(speed), projectileDamage(damage), projectileSize(size), isActive(true) {}
     
     void Update()
     {
         if (isActive)
         {
+            projectilePreviousPosition = projectilePosition;
             projectilePosition.x += projectileDirection.x * projectileSpeed;
             projectilePosition.y += projectileDirection.y * projectileSpeed;
-            if (projectilePosition.x < 0 || projectilePosition.x > SCREEN_WIDTH || projectilePosition.y < 0 || projectilePosition.y > SCREEN_HEIGHT)
-            {
-                isActive = false;
-            }
+        }
+    }
+
+    // Kept out of Update so the movement that carried a projectile off screen is still swept for collisions.
+    void CullOffScreen()
+    {
+        if (projectilePosition.x < 0 || projectilePosition.x > SCREEN_WIDTH || projectilePosition.y < 0 || projectilePosition.y > SCREEN_HEIGHT)
+        {
+            isActive = false;
         }
     }
     
@@ -142,12 +157,497 @@ class Projectile
         projectileObjects.emplace_back(startPosition, projectileDirection, speed, damage, size);
     }
     
+    // Box covering everywhere the projectile has been since its last update, used as a cheap broadphase.
+    Rectangle GetSweptBounds() const
+    {
+        return { std::min(projectilePreviousPosition.x, projectilePosition.x), std::min(projectilePreviousPosition.y, projectilePosition.y),
+                 fabsf(projectilePosition.x - projectilePreviousPosition.x) + projectileSize, fabsf(projectilePosition.y - projectilePreviousPosition.y) + projectileSize };
+    }
+
+    // Continuous collision: sweeps the projectile from its last position to its current one against a target that started at
+    // targetStart and moved by targetMovement over the same update. Both move at once, so this sweeps the projectile's movement
+    // relative to the target against the target's starting box.
+    // hitTime is how far along that movement the projectile first touches the target, from 0 to 1.
+    bool SweepAgainst(Rectangle targetStart, Vector2 targetMovement, float& hitTime) const
+    {
+        // Grow the target by the projectile size so the projectile can be treated as a point moving along a ray
+        float minBounds[2] = { targetStart.x - projectileSize, targetStart.y - projectileSize };
+        float maxBounds[2] = { targetStart.x + targetStart.width, targetStart.y + targetStart.height };
+        float start[2] = { projectilePreviousPosition.x, projectilePreviousPosition.y };
+        float delta[2] = { projectilePosition.x - projectilePreviousPosition.x - targetMovement.x, projectilePosition.y - projectilePreviousPosition.y - targetMovement.y };
+
+        float entryTime = 0;
+        float exitTime = 1;
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (fabsf(delta[axis]) < 1e-6f)
+            {
+                if (start[axis] < minBounds[axis] || start[axis] > maxBounds[axis]) return false;
+                continue;
+            }
+            float nearTime = (minBounds[axis] - start[axis]) / delta[axis];
+            float farTime = (maxBounds[axis] - start[axis]) / delta[axis];
+            if (nearTime > farTime) std::swap(nearTime, farTime);
+            entryTime = std::max(entryTime, nearTime);
+            exitTime = std::min(exitTime, farTime);
+            if (entryTime > exitTime) return false;
+        }
+        hitTime = entryTime;
+        return true;
+    }
+
     bool IsActive() const { return isActive; }
     Vector2 GetPosition() const { return projectilePosition; }
     int GetDamage() const { return projectileDamage; }
     int GetSize() const { return projectileSize; }
-    int GetSpeed() const { return projectileSpeed; }
-    int SetSpeed(int speed) { return projectileSpeed = speed; }
+    float GetSpeed() const { return projectileSpeed; }
+    float SetSpeed(float speed) { return projectileSpeed = speed; }
+};
+
+// Bullet Pattern Language
+// Patterns are written as whitespace separated words and compiled to bytecode once at startup, e.g:
+// "aim repeat 3 fire wait 0.1 end wait 1.5" fires an aimed three round burst every ~1.8 seconds.
+enum PatternOp
+{
+    OP_FIRE = 0,    // fire                 Fire one bullet along the emitter angle.
+    OP_RING = 1,    // ring <count>         Fire <count> bullets evenly spaced around the emitter.
+    OP_SPREAD = 2,  // spread <count> <arc> Fire <count> bullets across <arc> degrees centred on the emitter angle.
+    OP_AIM = 3,     // aim                  Point the emitter at the player.
+    OP_TURN = 4,    // turn <degrees>       Rotate the emitter.
+    OP_SPEED = 5,   // speed <speed>        Set the speed of bullets fired after this, must be above 0.
+    OP_WAIT = 6,    // wait <seconds>       Yield until the time has passed.
+    OP_REPEAT = 7,  // repeat <count>       Run everything up to the matching "end" <count> times.
+    OP_END = 8,
+};
+
+struct PatternInstruction
+{
+    PatternOp op;
+    int count;   // Bullets for ring / spread, loop count for repeat, jump target for end.
+    float value; // Degrees, seconds or speed.
+};
+
+#define PATTERN_MAX_LOOP_DEPTH 4
+#define PATTERN_MAX_INSTRUCTIONS_PER_TICK 256
+
+class BulletPattern
+{
+public:
+    std::vector<PatternInstruction> code;
+
+    bool IsValid() const { return !code.empty(); }
+
+    static BulletPattern Compile(const std::string& source)
+    {
+        BulletPattern pattern;
+        std::istringstream words(source);
+        std::vector<int> repeatStack;
+        std::string word;
+        while (words >> word)
+        {
+            PatternInstruction instruction = {OP_FIRE, 0, 0};
+            if (word == "fire") { instruction.op = OP_FIRE; }
+            else if (word == "aim") { instruction.op = OP_AIM; }
+            else if (word == "ring") { instruction.op = OP_RING; words >> instruction.count; }
+            else if (word == "spread") { instruction.op = OP_SPREAD; words >> instruction.count >> instruction.value; }
+            else if (word == "turn") { instruction.op = OP_TURN; words >> instruction.value; }
+            else if (word == "speed") { instruction.op = OP_SPEED; words >> instruction.value; }
+            else if (word == "wait") { instruction.op = OP_WAIT; words >> instruction.value; }
+            else if (word == "repeat")
+            {
+                instruction.op = OP_REPEAT;
+                words >> instruction.count;
+                if (repeatStack.size() >= PATTERN_MAX_LOOP_DEPTH) { std::cout << "Pattern Error: Too Many Nested Repeats In \"" << source << "\"" << std::endl; return {}; }
+                repeatStack.push_back(pattern.code.size());
+            }
+            else if (word == "end")
+            {
+                if (repeatStack.empty()) { std::cout << "Pattern Error: \"end\" Without \"repeat\" In \"" << source << "\"" << std::endl; return {}; }
+                instruction.op = OP_END;
+                instruction.count = repeatStack.back() + 1; // Jump to the first instruction inside the loop
+                repeatStack.pop_back();
+            }
+            else
+            {
+                std::cout << "Pattern Error: Unknown Word \"" << word << "\" In \"" << source << "\"" << std::endl;
+                return {};
+            }
+
+            bool needsCount = instruction.op == OP_RING || instruction.op == OP_SPREAD || instruction.op == OP_REPEAT;
+            bool badCount = instruction.count < 0 || (needsCount && instruction.count == 0);
+            bool badValue = (instruction.value < 0 && instruction.op != OP_TURN) || (instruction.op == OP_SPEED && instruction.value <= 0); // Bullets that never move never leave the screen
+            if (words.fail() || badCount || badValue)
+            {
+                std::cout << "Pattern Error: Bad Argument For \"" << word << "\" In \"" << source << "\"" << std::endl;
+                return {};
+            }
+            pattern.code.push_back(instruction);
+        }
+        if (!repeatStack.empty()) { std::cout << "Pattern Error: \"repeat\" Without \"end\" In \"" << source << "\"" << std::endl; return {}; }
+        return pattern;
+    }
+};
+
+class Emitter
+{
+public:
+    Emitter() = default;
+    Emitter(const BulletPattern* pattern, float bulletSpeed) : pattern(pattern), bulletSpeed(bulletSpeed) {}
+
+    // Runs the pattern until it waits, reaches the end of its code or uses up its instruction budget for this tick.
+    // Bullets are written straight into projectileObjects. Returns the number of instructions executed,
+    // waitSeconds is how long the pattern asked to wait before it runs again (0 means next tick).
+    int Step(std::vector<Projectile>& projectileObjects, Vector2 origin, Vector2 target, int damage, int size, float& waitSeconds)
+    {
+        waitSeconds = 0;
+        if (!pattern || !pattern->IsValid()) return 0;
+
+        const std::vector<PatternInstruction>& code = pattern->code;
+        int executed = 0;
+        while (executed < PATTERN_MAX_INSTRUCTIONS_PER_TICK)
+        {
+            const PatternInstruction& instruction = code[programCounter++];
+            executed++;
+            switch (instruction.op)
+            {
+                case OP_FIRE:
+                    Emit(projectileObjects, origin, emitterAngle, damage, size);
+                    break;
+                case OP_RING:
+                    for (int i = 0; i < instruction.count; i++)
+                    {
+                        Emit(projectileObjects, origin, emitterAngle + 360.0f * i / instruction.count, damage, size);
+                    }
+                    break;
+                case OP_SPREAD:
+                {
+                    float angleStep = instruction.count > 1 ? instruction.value / (instruction.count - 1) : 0;
+                    float startAngle = instruction.count > 1 ? emitterAngle - instruction.value / 2 : emitterAngle;
+                    for (int i = 0; i < instruction.count; i++)
+                    {
+                        Emit(projectileObjects, origin, startAngle + angleStep * i, damage, size);
+                    }
+                    break;
+                }
+                case OP_AIM:
+                    if (target.x != origin.x || target.y != origin.y) emitterAngle = atan2(target.y - origin.y, target.x - origin.x) * RAD2DEG;
+                    break;
+                case OP_TURN:
+                    emitterAngle = fmod(emitterAngle + instruction.value, 360.0f);
+                    break;
+                case OP_SPEED:
+                    bulletSpeed = instruction.value;
+                    break;
+                case OP_WAIT:
+                    waitSeconds += instruction.value;
+                    break;
+                case OP_REPEAT:
+                    loopCounters[loopDepth++] = instruction.count;
+                    break;
+                case OP_END:
+                    if (--loopCounters[loopDepth - 1] > 0) programCounter = instruction.count;
+                    else loopDepth--;
+                    break;
+            }
+
+            if (programCounter >= code.size())
+            {
+                // Patterns loop forever, but only one pass can happen per tick
+                programCounter = 0;
+                loopDepth = 0;
+                return executed;
+            }
+            if (waitSeconds > 0) return executed;
+        }
+        return executed;
+    }
+
+private:
+    void Emit(std::vector<Projectile>& projectileObjects, Vector2 origin, float angle, int damage, int size)
+    {
+        float rad = angle * DEG2RAD;
+        projectileObjects.emplace_back(origin, (Vector2){ cosf(rad), sinf(rad) }, bulletSpeed, damage, size);
+    }
+
+    const BulletPattern* pattern = nullptr;
+    size_t programCounter = 0;
+    int loopCounters[PATTERN_MAX_LOOP_DEPTH] = {};
+    int loopDepth = 0;
+    float emitterAngle = 0;
+    float bulletSpeed = 5;
+};
+
+#define TIMER_TICKS_PER_SECOND TARGET_FPS
+#define TIMER_WHEEL_LEVELS 3
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_MAX_TICKS_PER_ADVANCE 4
+
+// Hierarchical timer wheel driven by game time. Timers sit in a slot until they are due, so waiting costs nothing per tick.
+// Level 0 holds timers due within 64 ticks, level 1 within 64^2 and level 2 within 64^3. Higher levels are moved down a level
+// as the wheel turns, anything further out waits in the overflow list. Timers due on the same tick run in the order they were added.
+class TimerWheel
+{
+public:
+    // Awaitable for scripts, e.g. co_await gameTimers.Seconds(5);
+    struct TimerAwaiter
+    {
+        TimerWheel& timers;
+        uint64_t ticks;
+
+        bool await_ready() const { return false; }
+        void await_suspend(std::coroutine_handle<> script) { timers.Schedule(ticks, [script]() { script.resume(); }); }
+        void await_resume() const {}
+    };
+
+    TimerAwaiter Seconds(float seconds) { return {*this, SecondsToTicks(seconds)}; }
+    TimerAwaiter Ticks(uint64_t ticks) { return {*this, ticks}; }
+
+    // Timers always run on a later tick, a delay of 0 is treated as the next tick.
+    void Schedule(uint64_t delayTicks, std::function<void()> callback) { ScheduleAt(currentTick + delayTicks, std::move(callback)); }
+
+    void ScheduleAt(uint64_t dueTick, std::function<void()> callback)
+    {
+        Insert({std::max(dueTick, currentTick + 1), std::move(callback)});
+    }
+
+    // Turns the wheel by however many whole ticks deltaTime covers, up to TIMER_MAX_TICKS_PER_ADVANCE. Anything past that is dropped,
+    // so a long frame (window drag, load stall) slows game time down rather than running a whole wave or a pile of stacked emitter
+    // shots in one frame. Only call this while the game is running, pausing simply stops the wheel so everything resumes exactly where it left off.
+    void Advance(float deltaTime)
+    {
+        tickAccumulator += deltaTime;
+        for (int ticks = 0; tickAccumulator >= 1.0f / TIMER_TICKS_PER_SECOND; ticks++)
+        {
+            if (ticks == TIMER_MAX_TICKS_PER_ADVANCE)
+            {
+                tickAccumulator = 0;
+                break;
+            }
+            tickAccumulator -= 1.0f / TIMER_TICKS_PER_SECOND;
+            Tick();
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& level : wheelSlots)
+        {
+            for (auto& slot : level) slot.clear();
+        }
+        overflowTimers.clear();
+        currentTick = 0;
+        tickAccumulator = 0;
+    }
+
+    static uint64_t SecondsToTicks(double seconds) { return seconds > 0 ? (uint64_t)llround(seconds * TIMER_TICKS_PER_SECOND) : 0; }
+
+    // Runs after every tick's timers, e.g. to close out per tick stats. Clear leaves it in place.
+    void SetTickEndCallback(std::function<void()> callback) { tickEndCallback = std::move(callback); }
+
+    uint64_t GetTick() const { return currentTick; }
+    double GetTime() const { return (double)currentTick / TIMER_TICKS_PER_SECOND; }
+
+private:
+    struct Timer
+    {
+        uint64_t dueTick;
+        std::function<void()> callback;
+    };
+
+    void Insert(Timer&& timer)
+    {
+        uint64_t ticksUntilDue = timer.dueTick - currentTick;
+        for (int level = 0; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            if (ticksUntilDue < (1ull << (TIMER_WHEEL_BITS * (level + 1))))
+            {
+                size_t slot = (timer.dueTick >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SLOTS - 1);
+                wheelSlots[level][slot].push_back(std::move(timer));
+                return;
+            }
+        }
+        overflowTimers.push_back(std::move(timer));
+    }
+
+    void Cascade(std::vector<Timer>& timers)
+    {
+        std::vector<Timer> cascading;
+        cascading.swap(timers);
+        for (auto& timer : cascading) Insert(std::move(timer));
+    }
+
+    void Tick()
+    {
+        currentTick++;
+
+        // Each time a level wraps around, move the next slot of the level above down into finer slots
+        int level = 1;
+        for (; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            if (currentTick & ((1ull << (TIMER_WHEEL_BITS * level)) - 1)) break;
+            Cascade(wheelSlots[level][(currentTick >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SLOTS - 1)]);
+        }
+        if (level == TIMER_WHEEL_LEVELS && (currentTick & ((1ull << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1)) == 0) Cascade(overflowTimers);
+
+        // Swap the slot out first, callbacks are free to schedule more timers
+        std::vector<Timer> dueTimers;
+        dueTimers.swap(wheelSlots[0][currentTick & (TIMER_WHEEL_SLOTS - 1)]);
+        for (auto& timer : dueTimers) timer.callback();
+
+        if (tickEndCallback) tickEndCallback();
+    }
+
+    std::vector<Timer> wheelSlots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+    std::vector<Timer> overflowTimers;
+    uint64_t currentTick = 0;
+    float tickAccumulator = 0;
+    std::function<void()> tickEndCallback;
+};
+
+// Coroutine used for game scripts. Scripts start running straight away and are owned by whoever keeps the handle.
+struct ScriptTask
+{
+    struct promise_type
+    {
+        ScriptTask get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+struct EmitterHandle
+{
+    int slot = -1;
+    unsigned generation = 0;
+};
+
+class BulletPatternManager
+{
+public:
+    std::map<std::string, BulletPattern> patterns;
+    int instructionsLastTick = 0;
+    int instructionsPeak = 0;
+
+    void LoadPatterns()
+    {
+        patterns.clear();
+        patterns["aimed"] = BulletPattern::Compile("aim fire wait 1");
+        patterns["burst"] = BulletPattern::Compile("aim repeat 3 fire wait 0.1 end wait 1.5");
+        patterns["ring"] = BulletPattern::Compile("ring 12 turn 15 wait 1.5");
+        patterns["spiral"] = BulletPattern::Compile("repeat 36 fire turn 10 wait 0.05 end wait 1");
+        patterns["wave"] = BulletPattern::Compile("aim turn -30 repeat 6 fire turn 10 wait 0.08 end repeat 6 fire turn -10 wait 0.08 end wait 1");
+        patterns["bloom"] = BulletPattern::Compile("speed 3 ring 24 speed 5 aim spread 5 40 turn 7.5 wait 0.5");
+    }
+
+    const BulletPattern* GetPattern(const std::string& name) const
+    {
+        auto pattern = patterns.find(name);
+        if (pattern == patterns.end()) { std::cout << "No Bullet Pattern: " << name << std::endl; return nullptr; }
+        return &pattern->second;
+    }
+
+    // Emitters wait on the timer wheel between runs and write their bullets into projectileObjects.
+    void Reset(TimerWheel& timers, std::vector<Projectile>& projectileObjects)
+    {
+        this->timers = &timers;
+        this->projectileObjects = &projectileObjects;
+        timers.SetTickEndCallback([this]() { EndTick(); });
+        emitterSlots.clear();
+        freeSlots.clear();
+        instructionsThisTick = 0;
+        instructionsLastTick = 0;
+        instructionsPeak = 0;
+    }
+
+    EmitterHandle StartEmitter(const BulletPattern* pattern, Vector2 origin, int damage)
+    {
+        if (!pattern || !pattern->IsValid()) return {}; // A pattern that failed to compile would sit on the wheel doing nothing every tick
+        int slot;
+        if (freeSlots.empty())
+        {
+            slot = emitterSlots.size();
+            emitterSlots.push_back({});
+        }
+        else
+        {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        EmitterSlot& emitterSlot = emitterSlots[slot];
+        emitterSlot.emitter = Emitter(pattern, 5);
+        emitterSlot.origin = origin;
+        emitterSlot.damage = damage;
+        emitterSlot.nextRunTime = timers->GetTime();
+        emitterSlot.isActive = true;
+
+        EmitterHandle handle = {slot, emitterSlot.generation};
+        timers->Schedule(1, [this, handle]() { RunEmitter(handle); });
+        return handle;
+    }
+
+    // Stopped emitters are left on the wheel and ignored when their timer comes up.
+    void StopEmitter(EmitterHandle handle)
+    {
+        if (!IsValid(handle)) return;
+        emitterSlots[handle.slot].isActive = false;
+        emitterSlots[handle.slot].generation++;
+        freeSlots.push_back(handle.slot);
+    }
+
+    void MoveEmitter(EmitterHandle handle, Vector2 origin)
+    {
+        if (IsValid(handle)) emitterSlots[handle.slot].origin = origin;
+    }
+
+    void SetTarget(Vector2 target) { emitterTarget = target; }
+
+private:
+    // Closes out the instruction count at the end of every wheel tick.
+    void EndTick()
+    {
+        instructionsLastTick = instructionsThisTick;
+        instructionsPeak = std::max(instructionsPeak, instructionsLastTick);
+        instructionsThisTick = 0;
+    }
+
+    struct EmitterSlot
+    {
+        Emitter emitter;
+        Vector2 origin;
+        int damage;
+        double nextRunTime; // Game time in seconds, kept separately from the wheel tick so rounding never builds up
+        unsigned generation = 0;
+        bool isActive = false;
+    };
+
+    bool IsValid(EmitterHandle handle) const
+    {
+        return handle.slot >= 0 && handle.slot < (int)emitterSlots.size() && emitterSlots[handle.slot].isActive && emitterSlots[handle.slot].generation == handle.generation;
+    }
+
+    void RunEmitter(EmitterHandle handle)
+    {
+        if (!IsValid(handle)) return;
+        EmitterSlot& emitterSlot = emitterSlots[handle.slot];
+
+        float waitSeconds;
+        instructionsThisTick += emitterSlot.emitter.Step(*projectileObjects, emitterSlot.origin, emitterTarget, emitterSlot.damage, 5, waitSeconds);
+
+        emitterSlot.nextRunTime = std::max(emitterSlot.nextRunTime + waitSeconds, timers->GetTime());
+        timers->ScheduleAt(TimerWheel::SecondsToTicks(emitterSlot.nextRunTime), [this, handle]() { RunEmitter(handle); });
+    }
+
+    TimerWheel* timers = nullptr;
+    std::vector<Projectile>* projectileObjects = nullptr;
+    std::vector<EmitterSlot> emitterSlots;
+    std::vector<int> freeSlots;
+    Vector2 emitterTarget = {0, 0};
+    int instructionsThisTick = 0;
 };
 
 class Entity
@@ -171,7 +671,18 @@ class Entity
     void SetSize(int size) { entitySize = size; }
     
     Vector2 GetPosition() { return entityPosition; }
-    void SetPosition(Vector2 position) { entityPosition = position; }
+    void SetPosition(Vector2 position) { entityPosition = position; entityPreviousPosition = position; } // Placing an entity isn't a move
+
+    // Movement since the entity last moved, used to sweep projectiles against a moving target.
+    Vector2 GetMovement() { return {entityPosition.x - entityPreviousPosition.x, entityPosition.y - entityPreviousPosition.y}; }
+    Rectangle GetPreviousBounds() { return {entityPreviousPosition.x, entityPreviousPosition.y, (float)entitySize, (float)entitySize}; }
+
+    // Box covering everywhere the entity has been since it last moved, used as a cheap broadphase.
+    Rectangle GetSweptBounds()
+    {
+        return { std::min(entityPreviousPosition.x, entityPosition.x), std::min(entityPreviousPosition.y, entityPosition.y),
+                 fabsf(entityPosition.x - entityPreviousPosition.x) + entitySize, fabsf(entityPosition.y - entityPreviousPosition.y) + entitySize };
+    }
 
     void Destroy() { entityHealth = 0; }
     
@@ -182,6 +693,7 @@ class Entity
     int entityCollisionDamage = 25;
     int entitySize = 32;
     Vector2 entityPosition = {0, 0};
+    Vector2 entityPreviousPosition = {0, 0};
 };
 
 class Player : public Entity
@@ -194,26 +706,16 @@ class Player : public Entity
 
     void MultiShot(std::vector<Projectile>& projectileObjects, Vector2 startPosition, Vector2 targetPosition, int speed, int damage, int size)
     {
-        Vector2 baseDir = { targetPosition.x - startPosition.x, targetPosition.y - startPosition.y };
-        float mag = sqrt(baseDir.x * baseDir.x + baseDir.y * baseDir.y);
-        if (mag == 0) return;
-        baseDir.x /= mag;
-        baseDir.y /= mag;
-
-        float angles[3] = { -15.0f, 0.0f, 15.0f };
-        for (float a : angles)
-        {
-            float rad = a * DEG2RAD;
-            Vector2 dir = {
-                baseDir.x * cos(rad) - baseDir.y * sin(rad),
-                baseDir.x * sin(rad) + baseDir.y * cos(rad)
-            };
-            projectileObjects.emplace_back(startPosition, dir, speed, damage, size);
-        }
+        if (targetPosition.x == startPosition.x && targetPosition.y == startPosition.y) return; // Nothing to aim at
+        static const BulletPattern multiShotPattern = BulletPattern::Compile("aim spread 3 30");
+        Emitter multiShot(&multiShotPattern, speed);
+        float waitSeconds;
+        multiShot.Step(projectileObjects, startPosition, targetPosition, damage, size, waitSeconds);
     }
 
     void Move(std::vector<Projectile>& projectileObjects)
     {
+        entityPreviousPosition = entityPosition;
         if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D))
         {
             entityPosition.x += entitySpeed;
@@ -240,10 +742,13 @@ class Player : public Entity
         }
 
         
+        Vector2 unwrappedPosition = entityPosition;
         if (entityPosition.x > SCREEN_WIDTH) entityPosition.x = 0;
         if (entityPosition.x < 0) entityPosition.x = SCREEN_WIDTH;
         if (entityPosition.y > SCREEN_HEIGHT) entityPosition.y = 0;
         if (entityPosition.y < 0) entityPosition.y = SCREEN_HEIGHT;
+        // Wrapping is a teleport, not a move across the whole screen
+        if (entityPosition.x != unwrappedPosition.x || entityPosition.y != unwrappedPosition.y) entityPreviousPosition = entityPosition;
     }
 
     int SetPlayerLives(int lives) { return playerLives = lives; }
@@ -267,6 +772,7 @@ void Draw(TextureManager& TM) override
 
 void Move(Vector2 playerPosition)
 {
+    entityPreviousPosition = entityPosition;
     Vector2 direction = {playerPosition.x - entityPosition.x, playerPosition.y - entityPosition.y};
     float distance = sqrt(direction.x * direction.x + direction.y * direction.y);
     
@@ -279,29 +785,10 @@ void Move(Vector2 playerPosition)
         }
     }
     
-    void ShootAtPlayer(std::vector<Projectile>& projectileObjects, Vector2 playerPosition)
-    {
-        Vector2 direction = {playerPosition.x - entityPosition.x, playerPosition.y - entityPosition.y};
-        float distance = sqrt(direction.x * direction.x + direction.y * direction.y);
-        
-        if (distance > 0 && canShoot)
-        {
-            Projectile::Shoot(projectileObjects, entityPosition, playerPosition, 5, GetDamage(), 5);
-            canShoot = false;
-        }
-        else
-        {
-            shootCooldown -= GetFrameTime();
-            if (shootCooldown <= 0)
-            {
-                canShoot = true;
-                shootCooldown = 1;
-            }
-        }
-    }
+    EmitterHandle GetEmitter() const { return enemyEmitter; }
+    void SetEmitter(EmitterHandle emitter) { enemyEmitter = emitter; }
 private:
-float shootCooldown = 0;
-bool canShoot = false;
+EmitterHandle enemyEmitter;
 };
 
 class PowerUpManager 
@@ -352,36 +839,44 @@ std::vector<PowerUps> powerUps;
     }
 };
 
+#define ENEMIES_SPAWNED_PER_TICK 4
+
 class GameManager
 {
     public:
-    // Level Stats: {Level, Enemies To Spawn, Enemy Speed, Enemy Damage}
-    std::vector<std::tuple<int, int, float, int>> levelStats = {};
+    // Level Stats: {Level, Enemies To Spawn, Enemy Speed, Enemy Damage, Bullet Pattern}
+    std::vector<std::tuple<int, int, float, int, std::string>> levelStats = {};
     int playerScore = 0;
     void GenerateLevelStats()
     {
         levelStats.clear();
-        levelStats.push_back({1, 3, 1, 10});
-        levelStats.push_back({2, 5, 1.25, 10});
-        levelStats.push_back({3, 7, 1.5, 10});
-        levelStats.push_back({4, 9, 1.75, 10});
-        levelStats.push_back({5, 12, 2, 10});
+        levelStats.push_back({1, 3, 1, 10, "aimed"});
+        levelStats.push_back({2, 5, 1.25, 10, "aimed"});
+        levelStats.push_back({3, 7, 1.5, 10, "burst"});
+        levelStats.push_back({4, 9, 1.75, 10, "ring"});
+        levelStats.push_back({5, 12, 2, 10, "spiral"});
         // Dynamically generate more levels if needed
+        std::string generatedPatterns[] = {"burst", "wave", "ring", "spiral", "bloom"};
         for (int i = 6; i <= 99; ++i)
         {
             int enemiesToSpawn = 3 + (i - 1) * 1;
             float enemySpeed = 1 + (i - 1) * 0.25; // Enemy Speed Increases by 0.25 Every Level
             int enemyDamage = 10 + (i - 1) * 0.5;
-            levelStats.push_back({i, enemiesToSpawn, enemySpeed, enemyDamage});
-            std::cout << "Generated Level: " << i << " | Enemies: " << enemiesToSpawn << " | Damage: " << enemyDamage << "\n";
+            std::string bulletPattern = generatedPatterns[i % 5]; // Cycle Through Patterns Every Level
+            levelStats.push_back({i, enemiesToSpawn, enemySpeed, enemyDamage, bulletPattern});
+            std::cout << "Generated Level: " << i << " | Enemies: " << enemiesToSpawn << " | Damage: " << enemyDamage << " | Pattern: " << bulletPattern << "\n";
         }
     }
     
-    void SpawnEnemies()
+    // Starts a wave, the spawns are spread over the next few ticks.
+    void SpawnEnemies() { RunScript(SpawnWave()); }
+
+    ScriptTask SpawnWave()
     {
+        if (gameLevel < 1 || gameLevel > levelStats.size()) { std::cout << "No Enemy For Level: " << gameLevel << std::endl; co_return; }
         int enemySpeed = std::get<2>(levelStats[gameLevel - 1]);
         int enemyDamage = std::get<3>(levelStats[gameLevel - 1]);
-        if (gameLevel < 1 || gameLevel > levelStats.size()) { std::cout << "No Enemy For Level: " << gameLevel << std::endl; return; }
+        const BulletPattern* bulletPattern = BPM->GetPattern(std::get<4>(levelStats[gameLevel - 1]));
         int enemiesToSpawn = std::get<1>(levelStats[gameLevel - 1]);
         std::cout << "Game Level: " << gameLevel << " | Enemies Killed: " << enemiesKilled << std::endl;
         for (int i = 0; i < enemiesToSpawn; i++)
@@ -391,16 +886,55 @@ class GameManager
             enemy.SetPosition((Vector2){ GetRandomValue(-200, SCREEN_WIDTH + 200), GetRandomValue(-200, SCREEN_HEIGHT + 200) });
             enemy.SetSpeed(enemySpeed);
             enemy.SetDamage(enemyDamage);
+            enemy.SetEmitter(BPM->StartEmitter(bulletPattern, enemy.GetPosition(), enemyDamage));
             enemyUnits.push_back(enemy);
             std::cout << "Spawned: " << i + 1 << " Enemies" << std::endl;
+            if ((i + 1) % ENEMIES_SPAWNED_PER_TICK == 0) co_await gameTimers.Ticks(1);
         }
 }
 
-    void Initialize(TextureManager& TM, FontManager& FM, PowerUpManager& PM)
+    ScriptTask WaveScript()
+    {
+        while (true)
+        {
+            co_await gameTimers.Seconds(waveTimer);
+            std::cout << "Game Timer: " << gameTimer << " | Wave Timer: " << waveTimer << std::endl;
+            SpawnEnemies();
+        }
+    }
+
+    ScriptTask StatsScript()
+    {
+        while (true)
+        {
+            co_await gameTimers.Seconds(3);
+            std::cout << "Game Timer: " << gameTimer << " | Enemy Bullets: " << enemyProjectileObjects.size() << " | Pattern Instructions: " << BPM->instructionsLastTick << " (Peak: " << BPM->instructionsPeak << ")" << std::endl;
+        }
+    }
+
+    // Game scripts are owned here until they finish or the game restarts.
+    void RunScript(ScriptTask script)
+    {
+        gameScripts.erase( std::remove_if(gameScripts.begin(), gameScripts.end(), [](std::coroutine_handle<> s) { if (!s.done()) return false; s.destroy(); return true; }),
+        gameScripts.end());
+        gameScripts.push_back(script.handle);
+    }
+
+    void StopScripts()
+    {
+        gameTimers.Clear(); // Clear the wheel first, it may still hold timers that resume these scripts
+        for (auto& script : gameScripts) script.destroy();
+        gameScripts.clear();
+    }
+
+    ~GameManager() { StopScripts(); }
+
+    void Initialize(TextureManager& TM, FontManager& FM, PowerUpManager& PM, BulletPatternManager& BPM)
     {
         this->TM = &TM;
         this->FM = &FM;
         this->PM = &PM;
+        this->BPM = &BPM;
 
         PC.SetHealth(100);
         PC.SetSpeed(5);
@@ -419,8 +953,13 @@ class GameManager
         playerProjectileObjects.clear();
         enemyProjectileObjects.clear();
         PM.ClearPowerUps();
+        StopScripts();
+        BPM.LoadPatterns();
+        BPM.Reset(gameTimers, enemyProjectileObjects);
         GenerateLevelStats();
         SpawnEnemies();
+        RunScript(WaveScript());
+        RunScript(StatsScript());
     }
 
     void Update()
@@ -435,22 +974,16 @@ class GameManager
             HandleEnemies();
             HandleProjectiles();
             HandleCollision();
+            CullProjectiles();
             PM->DrawPowerUps();
 
             if (!isGamePaused)
             {
                 gameTimer += GetFrameTime();
 
-                if (fmod(gameTimer, 3.0f) < 0.01f)
-                {
-                    // Do Something
-                    std::cout << "Game Timer: " << gameTimer << std::endl;
-                }
-                if (fmod(gameTimer, waveTimer) < 0.01f)
-                {
-                    std::cout << "Game Timer: " << gameTimer << " | Wave Timer: " << waveTimer << std::endl;
-                    SpawnEnemies();
-                }
+                // Waves, emitters and any other scripted events only run from the timer wheel, which stays still while paused
+                BPM->SetTarget(PC.GetPosition());
+                gameTimers.Advance(GetFrameTime());
             }
         }
         else
@@ -481,7 +1014,7 @@ private:
         }
         if (IsKeyPressed(KEY_R) && isGamePaused)
         {
-            Initialize(*TM, *FM, *PM);
+            Initialize(*TM, *FM, *PM, *BPM);
         }
         if (isGameRunning && IsKeyPressed(KEY_P))
         {
@@ -494,16 +1027,6 @@ private:
                 enemy.SetSpeed(isGamePaused ? 0 : 3);
             }
 
-            for (auto& projectile : playerProjectileObjects)
-            {
-                projectile.SetSpeed(isGamePaused ? 0 : 10);
-            }
-
-            for (auto& projectile : enemyProjectileObjects)
-            {
-                projectile.SetSpeed(isGamePaused ? 0 : 5);
-            }
-
             PC.SetSpeed(isGamePaused ? 0 : 5);
 
             gameTimer = isGamePaused ? gameTimer : gameTimer;
@@ -517,7 +1040,7 @@ private:
             enemy.Draw(*TM);
             if (isGamePaused) continue;
             enemy.Move(PC.GetPosition());
-            enemy.ShootAtPlayer(enemyProjectileObjects, PC.GetPosition());
+            BPM->MoveEmitter(enemy.GetEmitter(), enemy.GetPosition());
             enemy.SetSpeed(std::get<2>(levelStats[gameLevel - 1]));
         }
         if (enemyUnits.empty()) { SpawnEnemies(); }
@@ -527,7 +1050,7 @@ private:
     {
         for (auto& projectile : playerProjectileObjects)
         {
-            projectile.Update();
+            if (!isGamePaused) projectile.Update();
             projectile.Draw(*TM);
         }
         playerProjectileObjects.erase( std::remove_if(playerProjectileObjects.begin(), playerProjectileObjects.end(), [](const Projectile& p) { return !p.IsActive(); }),
@@ -535,7 +1058,7 @@ private:
 
         for (auto& projectile : enemyProjectileObjects)
         {
-            projectile.Update();
+            if (!isGamePaused) projectile.Update();
             projectile.Draw(*TM);
         }
         enemyProjectileObjects.erase( std::remove_if(enemyProjectileObjects.begin(), enemyProjectileObjects.end(), [](const Projectile& p) { return !p.IsActive(); }),
@@ -549,8 +1072,7 @@ private:
             if (CheckCollisionRecs( {PC.GetPosition().x, PC.GetPosition().y, (float)PC.GetSize(), (float)PC.GetSize()}, {enemyUnits[i].GetPosition().x, enemyUnits[i].GetPosition().y, (float)enemyUnits[i].GetSize(), (float)enemyUnits[i].GetSize()}))
             {
                 PC.SetHealth(PC.GetHealth() - enemyUnits[i].GetCollisionDamage());
-                enemyUnits.erase(enemyUnits.begin() + i);
-                --i;
+                enemyUnits[i].Destroy();
                 if (PC.GetHealth() <= 0)
                 {
                     std::cout << "Player Health: " << PC.GetHealth() << std::endl;
@@ -562,55 +1084,84 @@ private:
                         isGameRunning = false;
                     }
                 }
-                continue;
             }
-            // Player Projectile Collision
-            for (size_t j = 0; j < playerProjectileObjects.size(); ++j)
+        }
+        // Player Projectile Collision
+        // Broadphase: pair up every projectile with the enemies its swept bounds overlap.
+        sweepCandidates.clear();
+        for (size_t j = 0; j < playerProjectileObjects.size(); ++j)
+        {
+            if (!playerProjectileObjects[j].IsActive()) continue;
+            Rectangle sweptBounds = playerProjectileObjects[j].GetSweptBounds();
+            for (size_t i = 0; i < enemyUnits.size(); ++i)
+            {
+                if (CheckCollisionRecs(sweptBounds, enemyUnits[i].GetSweptBounds())) sweepCandidates.push_back({j, i});
+            }
+        }
+        // Narrowphase: each projectile hits the first living enemy along its path this frame.
+        for (size_t c = 0; c < sweepCandidates.size();)
+        {
+            size_t j = sweepCandidates[c].first;
+            int hitEnemy = -1;
+            float firstHitTime = 2;
+            for (; c < sweepCandidates.size() && sweepCandidates[c].first == j; ++c)
             {
-                if (CheckCollisionRecs( {playerProjectileObjects[j].GetPosition().x, playerProjectileObjects[j].GetPosition().y, (float)playerProjectileObjects[j].GetSize(), (float)playerProjectileObjects[j].GetSize()}, {enemyUnits[i].GetPosition().x, enemyUnits[i].GetPosition().y, (float)enemyUnits[i].GetSize(), (float)enemyUnits[i].GetSize()}))
+                size_t i = sweepCandidates[c].second;
+                float hitTime;
+                if (enemyUnits[i].GetHealth() > 0 && playerProjectileObjects[j].SweepAgainst(enemyUnits[i].GetPreviousBounds(), enemyUnits[i].GetMovement(), hitTime) && hitTime < firstHitTime)
                 {
-                    enemyUnits[i].SetHealth(enemyUnits[i].GetHealth() - playerProjectileObjects[j].GetDamage());
-                    playerProjectileObjects.erase(playerProjectileObjects.begin() + j);
+                    firstHitTime = hitTime;
+                    hitEnemy = (int)i;
+                }
+            }
+            if (hitEnemy < 0) continue;
 
-                    if (enemyUnits[i].GetHealth() <= 0)
-                    {
-                        PowerUpType powerUpType = static_cast<PowerUpType>(GetRandomValue(HEALTH, PC.HasMultiShot() ? DAMAGE : MULTI_SHOT)); // Only spawn a multi-shot if the player doesn't already possess it.
-                        PM->SpawnPowerUp(enemyUnits[i].GetPosition(), TM->powerUpTextures[powerUpType], powerUpType);
-                        enemyUnits.erase(enemyUnits.begin() + i);
-                        enemiesKilled++;
-                        playerScore += 1;
-                        if (playerScore % 10 == 0)
-                        {
-                            gameLevel++;
-                            std::cout << "Level Up! New Level: " << gameLevel << std::endl;
-                            // I don't think I need to set the health & lives back here, the player is recovering health & lives from power-ups.
-                            // PC.SetHealth(100);
-                            // PC.SetPlayerLives(3);
-                        }
-                        --i;
-                    }
-                    break;
+            Enemy& enemy = enemyUnits[hitEnemy];
+            enemy.SetHealth(enemy.GetHealth() - playerProjectileObjects[j].GetDamage());
+            playerProjectileObjects[j].Destroy(); // Removed with the rest of the inactive projectiles next frame
+
+            if (enemy.GetHealth() <= 0)
+            {
+                enemy.Destroy();
+                PowerUpType powerUpType = static_cast<PowerUpType>(GetRandomValue(HEALTH, PC.HasMultiShot() ? DAMAGE : MULTI_SHOT)); // Only spawn a multi-shot if the player doesn't already possess it.
+                PM->SpawnPowerUp(enemy.GetPosition(), TM->powerUpTextures[powerUpType], powerUpType);
+                enemiesKilled++;
+                playerScore += 1;
+                if (playerScore % 10 == 0)
+                {
+                    gameLevel++;
+                    std::cout << "Level Up! New Level: " << gameLevel << std::endl;
+                    // I don't think I need to set the health & lives back here, the player is recovering health & lives from power-ups.
+                    // PC.SetHealth(100);
+                    // PC.SetPlayerLives(3);
                 }
             }
-            // Enemy Projectile Collision
-            for (size_t j = 0; j < enemyProjectileObjects.size(); ++j)
+        }
+        RemoveDeadEnemies();
+
+        // Enemy Projectile Collision
+        // Checked once per frame rather than once per enemy, bullet counts are far higher than enemy counts.
+        // Every bullet whose sweep hits this frame lands, a bullet skipped now would have swept past the player by next frame.
+        Rectangle playerSweptBounds = PC.GetSweptBounds();
+        Rectangle playerPreviousBounds = PC.GetPreviousBounds();
+        Vector2 playerMovement = PC.GetMovement();
+        for (auto& projectile : enemyProjectileObjects)
+        {
+            float hitTime;
+            if (projectile.IsActive() && CheckCollisionRecs(projectile.GetSweptBounds(), playerSweptBounds) && projectile.SweepAgainst(playerPreviousBounds, playerMovement, hitTime))
             {
-                if (CheckCollisionRecs( {enemyProjectileObjects[j].GetPosition().x, enemyProjectileObjects[j].GetPosition().y, (float)enemyProjectileObjects[j].GetSize(), (float)enemyProjectileObjects[j].GetSize()}, {PC.GetPosition().x, PC.GetPosition().y, (float)PC.GetSize(), (float)PC.GetSize()}))
+                PC.SetHealth(PC.GetHealth() - projectile.GetDamage());
+                projectile.Destroy(); // Removed with the rest of the inactive projectiles next frame
+                if (PC.GetHealth() <= 0)
                 {
-                    PC.SetHealth(PC.GetHealth() - enemyProjectileObjects[j].GetDamage());
-                    enemyProjectileObjects.erase(enemyProjectileObjects.begin() + j);
-                    if (PC.GetHealth() <= 0)
+                    std::cout << "Player Health: " << PC.GetHealth() << std::endl;
+                    PC.SetPlayerLives(PC.GetPlayerLives() - 1);
+                    std::cout << "Player Lives: " << PC.GetPlayerLives() << std::endl;
+                    PC.SetHealth(100);
+                    if (PC.GetPlayerLives() <= 0)
                     {
-                        std::cout << "Player Health: " << PC.GetHealth() << std::endl;
-                        PC.SetPlayerLives(PC.GetPlayerLives() - 1);
-                        std::cout << "Player Lives: " << PC.GetPlayerLives() << std::endl;
-                        PC.SetHealth(100);
-                        if (PC.GetPlayerLives() <= 0)
-                        {
-                            isGameRunning = false;
-                        }
+                        isGameRunning = false;
                     }
-                    break;
                 }
             }
         }
@@ -618,6 +1169,23 @@ private:
         PM->HandlePowerUpCollision(PC);
     }
 
+    // Projectiles leaving the screen are culled after collision and erased with the other inactive projectiles next frame.
+    void CullProjectiles()
+    {
+        for (auto& projectile : playerProjectileObjects) projectile.CullOffScreen();
+        for (auto& projectile : enemyProjectileObjects) projectile.CullOffScreen();
+    }
+
+    void RemoveDeadEnemies()
+    {
+        for (auto& enemy : enemyUnits)
+        {
+            if (enemy.GetHealth() <= 0) BPM->StopEmitter(enemy.GetEmitter());
+        }
+        enemyUnits.erase( std::remove_if(enemyUnits.begin(), enemyUnits.end(), [](Enemy& e) { return e.GetHealth() <= 0; }),
+        enemyUnits.end());
+    }
+
     void DisplayUI()
     {
         std::string healthText = "Health: " + std::to_string(PC.GetHealth());
@@ -669,11 +1237,16 @@ private:
     TextureManager* TM;
     FontManager* FM;
     PowerUpManager* PM;
+    BulletPatternManager* BPM;
 
     Player PC;
     std::vector<Enemy> enemyUnits;
     std::vector<Projectile> playerProjectileObjects;
     std::vector<Projectile> enemyProjectileObjects;
+    std::vector<std::pair<size_t, size_t>> sweepCandidates; // {Player Projectile, Enemy}, kept between frames to reuse its storage
+
+    TimerWheel gameTimers;
+    std::vector<std::coroutine_handle<>> gameScripts;
 
     float gameTimer = 0;
     float waveTimer = 5.0f;
@@ -693,14 +1266,87 @@ void CleanUp(FontManager& FM, TextureManager& TM)
     CloseWindow();
 }
 
-int main()
+// Headless benchmark for the bullet pattern engine, no window is opened.
+// Runs emitterCount emitters (cycling through every pattern) for tickCount wheel ticks, moving, sweeping and culling their bullets
+// against a target in the middle of the screen (bullets that hit it are destroyed), then reports pattern instructions, live bullets and time per tick.
+void RunBenchmark(int emitterCount, int tickCount)
 {
+    TimerWheel timers;
+    BulletPatternManager BPM;
+    std::vector<Projectile> projectileObjects;
+    BPM.LoadPatterns();
+    BPM.Reset(timers, projectileObjects);
+
+    Rectangle targetBounds = {SCREEN_WIDTH / 2 - 16, SCREEN_HEIGHT / 2 - 16, 32, 32};
+    BPM.SetTarget({targetBounds.x, targetBounds.y});
+
+    std::vector<const BulletPattern*> benchPatterns;
+    for (auto& pattern : BPM.patterns) benchPatterns.push_back(&pattern.second);
+    for (int i = 0; i < emitterCount; i++)
+    {
+        // Spread the emitters in a ring around the target
+        float angle = 2 * PI * i / emitterCount;
+        Vector2 origin = {SCREEN_WIDTH / 2 + cosf(angle) * SCREEN_WIDTH * 0.4f, SCREEN_HEIGHT / 2 + sinf(angle) * SCREEN_HEIGHT * 0.4f};
+        BPM.StartEmitter(benchPatterns[i % benchPatterns.size()], origin, 10);
+    }
+
+    long long totalInstructions = 0;
+    long long totalBullets = 0;
+    size_t peakBullets = 0;
+    long long targetHits = 0;
+    double totalTickTime = 0;
+    double peakTickTime = 0;
+    for (int tick = 0; tick < tickCount; tick++)
+    {
+        auto tickStart = std::chrono::steady_clock::now();
+
+        timers.Advance(1.0f / TIMER_TICKS_PER_SECOND);
+        for (auto& projectile : projectileObjects) projectile.Update();
+        for (auto& projectile : projectileObjects)
+        {
+            float hitTime;
+            if (CheckCollisionRecs(projectile.GetSweptBounds(), targetBounds) && projectile.SweepAgainst(targetBounds, {0, 0}, hitTime))
+            {
+                targetHits++;
+                projectile.Destroy(); // Bullets stop at the first hit, as they do in game
+            }
+            projectile.CullOffScreen();
+        }
+        projectileObjects.erase( std::remove_if(projectileObjects.begin(), projectileObjects.end(), [](const Projectile& p) { return !p.IsActive(); }),
+        projectileObjects.end());
+
+        double tickTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tickStart).count();
+        totalTickTime += tickTime;
+        peakTickTime = std::max(peakTickTime, tickTime);
+        totalInstructions += BPM.instructionsLastTick;
+        totalBullets += projectileObjects.size();
+        peakBullets = std::max(peakBullets, projectileObjects.size());
+    }
+
+    std::cout << "Benchmark: " << emitterCount << " Emitters | " << tickCount << " Ticks" << std::endl;
+    std::cout << "Pattern Instructions Per Tick: " << totalInstructions / tickCount << " (Peak: " << BPM.instructionsPeak << ")" << std::endl;
+    std::cout << "Live Bullets: " << totalBullets / tickCount << " (Peak: " << peakBullets << ") | Target Hits: " << targetHits << std::endl;
+    std::cout << "Time Per Tick: " << totalTickTime / tickCount << "ms (Peak: " << peakTickTime << "ms) | Frame Budget: " << 1000.0 / TARGET_FPS << "ms" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--bench")
+    {
+        int emitterCount = argc > 2 ? std::atoi(argv[2]) : 1000;
+        int tickCount = argc > 3 ? std::atoi(argv[3]) : 600;
+        if (emitterCount < 1 || tickCount < 1) { std::cout << "Usage: " << argv[0] << " --bench [Emitters] [Ticks]" << std::endl; return 1; }
+        RunBenchmark(emitterCount, tickCount);
+        return 0;
+    }
+
     GameManager GM;
     FontManager FM;
     TextureManager TM;
     PowerUpManager PM;
+    BulletPatternManager BPM;
     SetupGameWindow(TM, FM);
-    GM.Initialize(TM, FM, PM);
+    GM.Initialize(TM, FM, PM, BPM);
     while (!WindowShouldClose() && !GM.GameShouldClose())
     {
         BeginDrawing();